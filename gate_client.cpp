@@ -0,0 +1,316 @@
+// Reference client for the gate controller protocol (see gate_protocol.h).
+//
+// Usage: gate_client [host] [requests] [window]
+//
+// Sends the same park/exit workload over the binary gate port, with up to
+// <window> requests pipelined on one connection, and then over the HTTP
+// endpoints the dashboard uses. Prints bytes on the wire per operation for
+// both paths. For HTTP it also prints req/s per operation, since each request
+// is timed on its own. Pipelined binary requests overlap, so the binary path
+// gets one combined req/s figure. Only park and exit are measured because
+// HTTP has no per-plate lookup to set against OP_QUERY.
+//
+// Start the server with --no-log --quiet for a benchmark. Otherwise every
+// request appends to parking_log.txt and prints to the console under the lot
+// lock, so the comparison mostly measures logging.
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include "gate_protocol.h"
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#endif
+using namespace std;
+
+#ifdef _WIN32
+typedef SOCKET sock_t;
+#else
+typedef int sock_t;
+#endif
+
+enum BenchOp { BENCH_PARK = 0, BENCH_EXIT = 1, BENCH_OPS = 2 };
+
+struct OpStats {
+    int requests;
+    int ok;
+    size_t bytesSent;
+    size_t bytesReceived;
+    double seconds;
+};
+
+struct Stats {
+    OpStats ops[BENCH_OPS];
+    double seconds;
+};
+
+static void closeSocket(sock_t s) {
+#ifdef _WIN32
+    closesocket(s);
+#else
+    close(s);
+#endif
+}
+
+static bool connectTo(const string& host, int port, sock_t& s) {
+    s = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    inet_pton(AF_INET, host.c_str(), &addr.sin_addr);
+    if (connect(s, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        closeSocket(s);
+        return false;
+    }
+    int nodelay = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (char*)&nodelay, sizeof(nodelay));
+    return true;
+}
+
+static bool sendAll(sock_t s, const string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        int n = send(s, data.c_str() + sent, (int)(data.size() - sent), 0);
+        if (n <= 0) return false;
+        sent += n;
+    }
+    return true;
+}
+
+// Request i of the shared workload: park a plate, then exit it, so at most
+// one benchmark vehicle holds a slot at a time.
+static string plateFor(int i) {
+    return "GT" + to_string(i / 2);
+}
+
+static BenchOp opFor(int i) {
+    return i % 2 == 0 ? BENCH_PARK : BENCH_EXIT;
+}
+
+static void encodeRequest(string& out, int i) {
+    size_t mark;
+    gate::beginFrame(out, mark);
+    string plate = plateFor(i);
+    if (opFor(i) == BENCH_PARK) {
+        gate::putU8(out, gate::OP_PARK);
+        gate::putU32(out, (uint32_t)i);
+        gate::putU8(out, gate::VT_CAR);
+        gate::putStr(out, plate);
+        gate::putStr(out, "gate");
+    } else {
+        gate::putU8(out, gate::OP_EXIT);
+        gate::putU32(out, (uint32_t)i);
+        gate::putStr(out, plate);
+    }
+    gate::endFrame(out, mark);
+}
+
+static bool runBinary(const string& host, int total, int window, Stats& st) {
+    st = Stats{};
+    sock_t s;
+    if (!connectTo(host, gate::DEFAULT_PORT, s)) {
+        cout << "[ERROR] Cannot connect to gate port " << gate::DEFAULT_PORT << endl;
+        return false;
+    }
+
+    auto start = chrono::steady_clock::now();
+    string pending;
+    char buffer[8192];
+    int next = 0;
+    int answered = 0;
+
+    while (answered < total) {
+        // Keep at most <window> requests in flight.
+        string batch;
+        int inFlight = next - answered;
+        while (next < total && inFlight < window) {
+            size_t before = batch.size();
+            encodeRequest(batch, next);
+            st.ops[opFor(next)].requests++;
+            st.ops[opFor(next)].bytesSent += batch.size() - before;
+            next++;
+            inFlight++;
+        }
+        if (!batch.empty() && !sendAll(s, batch)) break;
+
+        int n = recv(s, buffer, sizeof(buffer), 0);
+        if (n <= 0) break;
+        pending.append(buffer, n);
+
+        size_t pos = 0;
+        while (pending.size() - pos >= 4) {
+            uint32_t len = gate::getU32((const unsigned char*)pending.data() + pos);
+            if (pending.size() - pos - 4 < len) break;
+            gate::Reader in(pending.data() + pos + 4, len);
+            in.u8();
+            uint32_t requestId = in.u32();
+            uint8_t status = in.u8();
+            if (requestId != (uint32_t)answered) {
+                cout << "[ERROR] Out-of-order response " << requestId
+                     << " (expected " << answered << ")" << endl;
+                closeSocket(s);
+                return false;
+            }
+            OpStats& op = st.ops[opFor(answered)];
+            if (status == gate::ST_OK) op.ok++;
+            op.bytesReceived += 4 + len;
+            answered++;
+            pos += 4 + len;
+        }
+        pending.erase(0, pos);
+    }
+
+    st.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    closeSocket(s);
+    return answered == total;
+}
+
+static bool runHTTP(const string& host, int total, Stats& st) {
+    st = Stats{};
+    auto start = chrono::steady_clock::now();
+    char buffer[8192];
+
+    for (int i = 0; i < total; i++) {
+        string plate = plateFor(i);
+        string body;
+        string request;
+        if (opFor(i) == BENCH_PARK) {
+            body = "type=Car&plate=" + plate + "&owner=gate";
+            request = "POST /park HTTP/1.1\r\n";
+        } else {
+            body = "plate=" + plate;
+            request = "POST /exit HTTP/1.1\r\n";
+        }
+        request += "Host: " + host + "\r\n"
+                   "Content-Type: application/x-www-form-urlencoded\r\n"
+                   "Content-Length: " + to_string(body.size()) + "\r\n\r\n" + body;
+
+        OpStats& op = st.ops[opFor(i)];
+        auto t0 = chrono::steady_clock::now();
+
+        // The web server closes after every reply, so each request pays a connect.
+        sock_t s;
+        if (!connectTo(host, 8080, s)) {
+            cout << "[ERROR] Cannot connect to web server on 8080" << endl;
+            return false;
+        }
+        if (!sendAll(s, request)) {
+            closeSocket(s);
+            return false;
+        }
+
+        string response;
+        int n;
+        while ((n = recv(s, buffer, sizeof(buffer), 0)) > 0) {
+            response.append(buffer, n);
+        }
+        closeSocket(s);
+
+        op.seconds += chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+        op.requests++;
+        op.bytesSent += request.size();
+        op.bytesReceived += response.size();
+        if (response.find("\"success\":true") != string::npos) op.ok++;
+    }
+
+    st.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+static void reportLine(const string& label, int requests, double seconds, size_t sent, size_t received, int ok) {
+    cout << left << setw(14) << label << right
+         << setw(8) << requests << " req";
+    if (seconds > 0) {
+        cout << setw(12) << fixed << setprecision(0) << requests / seconds << " req/s";
+    } else {
+        cout << setw(18) << "";
+    }
+    cout << setw(10) << fixed << setprecision(1) << (double)sent / requests << " B/req out"
+         << setw(10) << (double)received / requests << " B/req in"
+         << setw(8) << ok << " ok" << endl;
+}
+
+static void reportOp(const string& label, const OpStats& op) {
+    if (op.requests == 0) return;
+    reportLine(label, op.requests, op.seconds, op.bytesSent, op.bytesReceived, op.ok);
+}
+
+// Returns false when any request was refused; the numbers then measure
+// rejections rather than real parks and exits.
+static bool report(const string& label, const Stats& st) {
+    reportOp(label + " park", st.ops[BENCH_PARK]);
+    reportOp(label + " exit", st.ops[BENCH_EXIT]);
+
+    OpStats all = {};
+    for (int k = 0; k < BENCH_OPS; k++) {
+        all.requests += st.ops[k].requests;
+        all.ok += st.ops[k].ok;
+        all.bytesSent += st.ops[k].bytesSent;
+        all.bytesReceived += st.ops[k].bytesReceived;
+    }
+    reportLine(label + " total", all.requests, st.seconds, all.bytesSent, all.bytesReceived, all.ok);
+
+    bool allOk = true;
+    for (int k = 0; k < BENCH_OPS; k++) {
+        if (st.ops[k].ok < st.ops[k].requests) allOk = false;
+    }
+    if (!allOk) {
+        cout << "[WARN] " << label << ": not every request succeeded. Start from an empty lot"
+             << " and make sure no GT* plates are parked, or these numbers compare rejections." << endl;
+    }
+    return allOk;
+}
+
+static size_t totalBytes(const Stats& st) {
+    size_t bytes = 0;
+    for (int k = 0; k < BENCH_OPS; k++) bytes += st.ops[k].bytesSent + st.ops[k].bytesReceived;
+    return bytes;
+}
+
+int main(int argc, char* argv[]) {
+    string host = argc > 1 ? argv[1] : "127.0.0.1";
+    int total = argc > 2 ? atoi(argv[2]) : 3000;
+    int window = argc > 3 ? atoi(argv[3]) : 64;
+    if (total <= 0) total = 3000;
+    total += total % 2;  // every park is paired with its exit
+    if (window <= 0) window = 1;
+
+#ifdef _WIN32
+    WSADATA wsaData;
+    WSAStartup(MAKEWORD(2, 2), &wsaData);
+#endif
+
+    cout << "[INFO] " << total << " requests (park/exit), pipeline window " << window << endl;
+    cout << "[INFO] Run the server with --no-log --quiet, or these requests are logged to parking_log.txt" << endl;
+
+    Stats binary, http;
+    if (!runBinary(host, total, window, binary)) return 1;
+    bool binaryOk = report("binary", binary);
+    if (!runHTTP(host, total, http)) return 1;
+    bool httpOk = report("http", http);
+
+    if (binary.seconds > 0 && http.seconds > 0) {
+        cout << "[INFO] Binary path is " << fixed << setprecision(1)
+             << http.seconds / binary.seconds << "x faster, "
+             << (double)totalBytes(http) / totalBytes(binary)
+             << "x fewer bytes" << endl;
+    }
+
+#ifdef _WIN32
+    WSACleanup();
+#endif
+    return binaryOk && httpOk ? 0 : 1;
+}
@@ -0,0 +1,146 @@
+#ifndef GATE_PROTOCOL_H
+#define GATE_PROTOCOL_H
+
+// Compact binary protocol spoken by the barrier controllers on the gate port.
+//
+// Every frame is a 4-byte big-endian payload length followed by the payload.
+// Payload layout (all integers big-endian):
+//
+//   request:  u8 op | u32 requestId | body
+//     PARK   body: u8 type | u8 plateLen | plate | u8 ownerLen | owner
+//     EXIT   body: u8 plateLen | plate
+//     QUERY  body: u8 plateLen | plate
+//
+//   response: u8 op | u32 requestId | u8 status | body
+//     PARK   body: u16 available
+//     EXIT   body: u32 feePaise | u16 available
+//     QUERY  body: u8 parked | u32 feePaise | u16 available
+//
+// Clients may pipeline any number of requests on one connection; responses
+// come back in request order and carry the requestId they answer.
+
+#include <cstdint>
+#include <string>
+
+namespace gate {
+
+const uint16_t DEFAULT_PORT = 9090;
+const uint32_t MAX_FRAME = 1024;
+
+enum Op : uint8_t {
+    OP_PARK  = 1,
+    OP_EXIT  = 2,
+    OP_QUERY = 3
+};
+
+enum Status : uint8_t {
+    ST_OK             = 0,
+    ST_FULL           = 1,
+    ST_NOT_FOUND      = 2,
+    ST_BAD_FRAME      = 3,
+    ST_ALREADY_PARKED = 4
+};
+
+enum VehicleType : uint8_t {
+    VT_CAR   = 1,
+    VT_BIKE  = 2,
+    VT_TRUCK = 3
+};
+
+inline const char* typeName(uint8_t t) {
+    switch (t) {
+        case VT_CAR:   return "Car";
+        case VT_BIKE:  return "Bike";
+        case VT_TRUCK: return "Truck";
+        default:       return nullptr;
+    }
+}
+
+inline void putU8(std::string& out, uint8_t v) {
+    out.push_back((char)v);
+}
+
+inline void putU16(std::string& out, uint16_t v) {
+    out.push_back((char)(v >> 8));
+    out.push_back((char)(v & 0xFF));
+}
+
+inline void putU32(std::string& out, uint32_t v) {
+    out.push_back((char)(v >> 24));
+    out.push_back((char)((v >> 16) & 0xFF));
+    out.push_back((char)((v >> 8) & 0xFF));
+    out.push_back((char)(v & 0xFF));
+}
+
+inline void putStr(std::string& out, const std::string& s) {
+    size_t len = s.size() > 255 ? 255 : s.size();
+    putU8(out, (uint8_t)len);
+    out.append(s, 0, len);
+}
+
+inline uint16_t getU16(const unsigned char* p) {
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+inline uint32_t getU32(const unsigned char* p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+// Bounds-checked reader over a single frame payload.
+struct Reader {
+    const unsigned char* p;
+    size_t left;
+    bool ok;
+
+    Reader(const char* data, size_t len) : p((const unsigned char*)data), left(len), ok(true) {}
+
+    uint8_t u8() {
+        if (left < 1) { ok = false; return 0; }
+        left -= 1;
+        return *p++;
+    }
+
+    uint16_t u16() {
+        if (left < 2) { ok = false; return 0; }
+        uint16_t v = getU16(p);
+        p += 2; left -= 2;
+        return v;
+    }
+
+    uint32_t u32() {
+        if (left < 4) { ok = false; return 0; }
+        uint32_t v = getU32(p);
+        p += 4; left -= 4;
+        return v;
+    }
+
+    std::string str() {
+        uint8_t len = u8();
+        if (!ok || left < len) { ok = false; return std::string(); }
+        std::string s((const char*)p, len);
+        p += len; left -= len;
+        return s;
+    }
+};
+
+// Prepends the length prefix once the payload has been built in place.
+inline void beginFrame(std::string& out, size_t& mark) {
+    mark = out.size();
+    putU32(out, 0);
+}
+
+inline void endFrame(std::string& out, size_t mark) {
+    uint32_t len = (uint32_t)(out.size() - mark - 4);
+    out[mark]     = (char)(len >> 24);
+    out[mark + 1] = (char)((len >> 16) & 0xFF);
+    out[mark + 2] = (char)((len >> 8) & 0xFF);
+    out[mark + 3] = (char)(len & 0xFF);
+}
+
+inline uint32_t toPaise(double fee) {
+    return fee <= 0 ? 0 : (uint32_t)(fee * 100.0 + 0.5);
+}
+
+} // namespace gate
+
+#endif
@@ -0,0 +1,561 @@
+#ifndef PARKING_LOT_H
+#define PARKING_LOT_H
+
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <deque>
+#include <queue>
+#include <functional>
+#include <algorithm>
+
+// Source of "now" for ParkingLot. The server uses the wall clock; the
+// simulator swaps in a VirtualClock so a whole day runs in milliseconds.
+struct Clock {
+    virtual ~Clock() {}
+    virtual time_t now() = 0;
+};
+
+struct SystemClock : Clock {
+    time_t now() override { return time(nullptr); }
+};
+
+struct VirtualClock : Clock {
+    time_t current;
+
+    VirtualClock(time_t start = 0) : current(start) {}
+    time_t now() override { return current; }
+    void set(time_t t) { current = t; }
+};
+
+enum ParkResult {
+    PARK_OK,
+    PARK_FULL,
+    PARK_ALREADY_PARKED
+};
+
+struct LotOptions {
+    std::string logPath = "parking_log.txt";  // empty disables the log file
+    bool echo = true;                         // print [INFO] lines to the console
+    size_t historyLimit = 100;                // exited vehicles kept for the dashboard
+};
+
+struct Vehicle {
+    std::string plateNumber;
+    std::string ownerName;
+    std::string type;
+    time_t entryTime;
+    time_t exitTime;
+    bool isParked;
+    int slot;
+
+    Vehicle(const std::string& plate, const std::string& owner, const std::string& t, time_t entry, int s) {
+        plateNumber = plate;
+        ownerName = owner;
+        type = t;
+        entryTime = entry;
+        slot = s;
+        exitTime = 0;
+        isParked = true;
+    }
+};
+
+class ParkingLot {
+private:
+    std::vector<Vehicle> slots;                           // parked vehicles, in no particular order
+    std::unordered_map<std::string, size_t> parkedIndex;  // plate -> index in slots
+    std::deque<Vehicle> history;                          // most recent exits, oldest first
+    std::priority_queue<int, std::vector<int>, std::greater<int>> freeSlots;  // lowest free slot on top
+    int capacity;
+    int occupied;
+    SystemClock systemClock;
+    Clock* clock;
+    LotOptions options;
+    std::ofstream logFile;
+    std::mutex mtx;  // WebServer and GateServer share the lot from different threads
+
+    static double feeFor(const Vehicle& v, time_t exitTime) {
+        double hours = difftime(exitTime, v.entryTime) / 3600.0;
+        if (hours < 1) hours = 1;
+        double fee = 0;
+        if (v.type == "Car") fee = hours * 20;
+        else if (v.type == "Bike") fee = hours * 10;
+        else if (v.type == "Truck") fee = hours * 30;
+        return fee;
+    }
+
+    // History first, then parked vehicles by slot, as the dashboard lists them.
+    std::vector<const Vehicle*> listedVehicles() const {
+        std::vector<const Vehicle*> list;
+        list.reserve(history.size() + slots.size());
+        for (const auto &v : history) list.push_back(&v);
+        size_t firstParked = list.size();
+        for (const auto &v : slots) list.push_back(&v);
+        std::sort(list.begin() + firstParked, list.end(),
+                  [](const Vehicle* a, const Vehicle* b) { return a->slot < b->slot; });
+        return list;
+    }
+
+public:
+    ParkingLot(int cap, Clock* clk = nullptr, LotOptions opts = LotOptions()) {
+        capacity = cap;
+        occupied = 0;
+        for (int s = 1; s <= cap; s++) freeSlots.push(s);
+        clock = clk ? clk : &systemClock;
+        options = opts;
+        if (!options.logPath.empty()) {
+            logFile.open(options.logPath, std::ios::app);
+            if (!logFile) {
+                std::cout << "[ERROR] Unable to open file!" << std::endl;
+            }
+        }
+    }
+
+    ~ParkingLot() {
+        if (logFile.is_open()) logFile.close();
+    }
+
+    // Refuses when the lot is full or the plate is already parked. Each
+    // operation below reports the free slot count seen under the same lock.
+    ParkResult parkVehicle(const std::string& plate, const std::string& owner, const std::string& type,
+                           int* availableOut = nullptr) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (availableOut) *availableOut = capacity - occupied;
+        if (parkedIndex.count(plate)) {
+            return PARK_ALREADY_PARKED;
+        }
+        if (occupied >= capacity) {
+            return PARK_FULL;
+        }
+        int slot = freeSlots.top();
+        freeSlots.pop();
+        slots.emplace_back(plate, owner, type, clock->now(), slot);
+        parkedIndex[plate] = slots.size() - 1;
+        occupied++;
+        if (availableOut) *availableOut = capacity - occupied;
+        const Vehicle& v = slots.back();
+
+        if (options.echo) {
+            std::cout << "[INFO] Parked " << type << " " << plate 
+                 << " at slot " << v.slot 
+                 << " (Entry: " << std::put_time(localtime(&v.entryTime), "%H:%M:%S") << ")" << std::endl;
+        }
+
+        if (logFile.is_open()) {
+            std::string entryTime = asctime(localtime(&v.entryTime));
+            entryTime.pop_back();
+
+            logFile << "[PARK] " << type << " " << plate 
+                    << " | Owner: " << owner
+                    << " | Entry: " << entryTime << std::endl;
+            logFile.flush();
+        }
+        return PARK_OK;
+    }
+
+    double calculateFee(const std::string& plate) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = parkedIndex.find(plate);
+        if (it == parkedIndex.end()) return 0;
+        return feeFor(slots[it->second], clock->now());
+    }
+
+    bool exitVehicle(const std::string& plate, double* feeOut = nullptr, int* availableOut = nullptr) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (availableOut) *availableOut = capacity - occupied;
+        auto it = parkedIndex.find(plate);
+        if (it == parkedIndex.end()) return false;
+
+        size_t idx = it->second;
+        parkedIndex.erase(it);
+        occupied--;
+        if (availableOut) *availableOut = capacity - occupied;
+
+        Vehicle& v = slots[idx];
+        v.exitTime = clock->now();
+        v.isParked = false;
+
+        double fee = feeFor(v, v.exitTime);
+        if (feeOut) *feeOut = fee;
+
+        if (options.echo) {
+            std::cout << "[INFO] Vehicle " << v.plateNumber 
+                 << " leaving slot. Fee = Rs " << std::fixed << std::setprecision(2) << fee 
+                 << " (Entry: " << std::put_time(localtime(&v.entryTime), "%H:%M:%S")
+                 << " Exit: " << std::put_time(localtime(&v.exitTime), "%H:%M:%S") << ")" 
+                 << std::endl;
+        }
+
+        if (logFile.is_open()) {
+            std::string entryTime = asctime(localtime(&v.entryTime));
+            entryTime.pop_back();
+            std::string exitTime = asctime(localtime(&v.exitTime));
+            exitTime.pop_back();
+
+            logFile << "[EXIT] " << v.type << " " << v.plateNumber 
+                    << " | Owner: " << v.ownerName
+                    << " | Entry: " << entryTime 
+                    << " | Exit: " << exitTime
+                    << " | Fee: Rs " << std::fixed << std::setprecision(2) << fee << std::endl;
+            logFile.flush();
+        }
+
+        // Free the slot, keep a bounded record for the dashboard, and fill the
+        // gap in slots with the last parked vehicle.
+        freeSlots.push(v.slot);
+        if (options.historyLimit > 0) {
+            history.push_back(v);
+            if (history.size() > options.historyLimit) history.pop_front();
+        }
+        if (idx != slots.size() - 1) {
+            slots[idx] = std::move(slots.back());
+            parkedIndex[slots[idx].plateNumber] = idx;
+        }
+        slots.pop_back();
+        return true;
+    }
+
+    // Reports whether a plate is currently parked and, if so, the fee owed so far.
+    bool queryVehicle(const std::string& plate, double* feeOut = nullptr, int* availableOut = nullptr) {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (availableOut) *availableOut = capacity - occupied;
+        auto it = parkedIndex.find(plate);
+        if (it == parkedIndex.end()) {
+            if (feeOut) *feeOut = 0;
+            return false;
+        }
+        if (feeOut) *feeOut = feeFor(slots[it->second], clock->now());
+        return true;
+    }
+
+    std::string getJSONData() {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::ostringstream json;
+        json << "{\"capacity\":" << capacity << ",\"occupied\":" << occupied 
+             << ",\"available\":" << (capacity - occupied) << ",\"vehicles\":[";
+        
+        int numCars = 0, numBikes = 0, numTrucks = 0, numActive = 0;
+        std::vector<const Vehicle*> list = listedVehicles();
+        for (size_t i = 0; i < list.size(); i++) {
+            const auto &v = *list[i];
+            if (v.type == "Car") numCars++;
+            else if (v.type == "Bike") numBikes++;
+            else if (v.type == "Truck") numTrucks++;
+            if (v.isParked) numActive++;
+
+            if (i > 0) json << ",";
+            char entryBuf[32], exitBuf[32];
+            strftime(entryBuf, sizeof(entryBuf), "%Y-%m-%d %H:%M:%S", localtime(&v.entryTime));
+            if (v.exitTime != 0) {
+                strftime(exitBuf, sizeof(exitBuf), "%Y-%m-%d %H:%M:%S", localtime(&v.exitTime));
+            } else {
+                strcpy(exitBuf, "-");
+            }
+            
+            json << "{\"slot\":" << v.slot << ",\"type\":\"" << v.type 
+                 << "\",\"plate\":\"" << v.plateNumber << "\",\"owner\":\"" << v.ownerName
+                 << "\",\"entry\":\"" << entryBuf << "\",\"exit\":\"" << exitBuf
+                 << "\",\"parked\":" << (v.isParked ? "true" : "false") << "}";
+        }
+        
+        json << "],\"stats\":{\"cars\":" << numCars << ",\"bikes\":" << numBikes 
+             << ",\"trucks\":" << numTrucks << ",\"active\":" << numActive << "}}";
+        return json.str();
+    }
+
+    std::string getDashboardHTML() {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::ostringstream html;
+        int available = capacity - occupied;
+        int numCars = 0, numBikes = 0, numTrucks = 0, numActive = 0;
+        std::vector<const Vehicle*> list = listedVehicles();
+        for (const Vehicle* p : list) {
+            const auto &v = *p;
+            if (v.type == "Car") numCars++;
+            else if (v.type == "Bike") numBikes++;
+            else if (v.type == "Truck") numTrucks++;
+            if (v.isParked) numActive++;
+        }
+        double usage = capacity > 0 ? (100.0 * occupied / capacity) : 0.0;
+
+        html << R"HTML(<!DOCTYPE html>
+<html lang="en">
+<head>
+<meta charset="UTF-8">
+<meta name="viewport" content="width=device-width, initial-scale=1.0">
+<title>Smart Parking Dashboard</title>
+<style>
+*{margin:0;padding:0;box-sizing:border-box}
+body{font-family:'Segoe UI',Arial,sans-serif;background:#f6f8fb;color:#222;padding:20px}
+.header{background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);color:#fff;padding:24px;border-radius:12px;margin-bottom:24px;box-shadow:0 4px 15px rgba(0,0,0,.1)}
+h1{font-size:32px;margin-bottom:8px}
+.subtitle{opacity:.9;font-size:14px}
+.container{max-width:1400px;margin:0 auto}
+.cards{display:grid;grid-template-columns:repeat(auto-fit,minmax(200px,1fr));gap:16px;margin-bottom:24px}
+.card{background:#fff;border-radius:12px;box-shadow:0 2px 10px rgba(0,0,0,.08);padding:20px;transition:transform .2s}
+.card:hover{transform:translateY(-2px);box-shadow:0 4px 15px rgba(0,0,0,.12)}
+.card-label{color:#666;font-size:13px;text-transform:uppercase;letter-spacing:.5px;margin-bottom:8px}
+.card-value{font-size:36px;font-weight:700;color:#333}
+.usage-card{background:#fff;border-radius:12px;box-shadow:0 2px 10px rgba(0,0,0,.08);padding:20px;margin-bottom:24px}
+.bar{height:16px;border-radius:8px;background:#e9eef7;overflow:hidden;margin-top:12px}
+.fill{height:100%;background:linear-gradient(90deg,#667eea,#764ba2);transition:width .3s}
+.actions{display:grid;grid-template-columns:1fr 1fr;gap:20px;margin-bottom:24px}
+.action-panel{background:#fff;border-radius:12px;box-shadow:0 2px 10px rgba(0,0,0,.08);padding:24px}
+.action-panel h2{font-size:20px;margin-bottom:16px;color:#333}
+.form-group{margin-bottom:16px}
+label{display:block;margin-bottom:6px;color:#555;font-weight:500;font-size:14px}
+input,select{width:100%;padding:10px 12px;border:2px solid #e0e0e0;border-radius:8px;font-size:14px;transition:border .2s}
+input:focus,select:focus{outline:none;border-color:#667eea}
+button{width:100%;padding:12px;background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);color:#fff;border:none;border-radius:8px;font-size:16px;font-weight:600;cursor:pointer;transition:opacity .2s}
+button:hover{opacity:.9}
+button:active{opacity:.8}
+.vehicles-table{background:#fff;border-radius:12px;box-shadow:0 2px 10px rgba(0,0,0,.08);overflow:hidden}
+table{width:100%;border-collapse:collapse}
+th,td{padding:14px 16px;text-align:left;border-bottom:1px solid #f0f0f0}
+th{background:#f8f9fa;font-weight:600;color:#555;font-size:13px;text-transform:uppercase;letter-spacing:.5px}
+tr:hover{background:#f8f9fa}
+.status{font-size:12px;padding:4px 12px;border-radius:20px;display:inline-block;font-weight:500}
+.status-parked{background:#e7f7ee;color:#0f7b3f}
+.status-exited{background:#fdecec;color:#b42318}
+.message{padding:12px 16px;border-radius:8px;margin-bottom:16px;font-size:14px;display:none}
+.message-success{background:#e7f7ee;color:#0f7b3f;border:1px solid #a8e6c7}
+.message-error{background:#fdecec;color:#b42318;border:1px solid #f5a5a5}
+.refresh-btn{position:fixed;bottom:24px;right:24px;width:60px;height:60px;border-radius:50%;background:linear-gradient(135deg,#667eea 0%,#764ba2 100%);color:#fff;border:none;font-size:24px;cursor:pointer;box-shadow:0 4px 15px rgba(0,0,0,.2);transition:transform .2s}
+.refresh-btn:hover{transform:rotate(180deg) scale(1.1)}
+</style>
+</head>
+<body>
+<div class="container">
+<div class="header">
+<h1>🚗 Smart Parking System</h1>
+<p class="subtitle">Real-time Parking Management Dashboard</p>
+</div>
+
+<div id="message" class="message"></div>
+
+<div class="cards">
+<div class="card">
+<div class="card-label">Total Capacity</div>
+<div class="card-value" id="capacity">)" << capacity << R"(</div>
+</div>
+<div class="card">
+<div class="card-label">Occupied</div>
+<div class="card-value" id="occupied">)" << occupied << R"(</div>
+</div>
+<div class="card">
+<div class="card-label">Available</div>
+<div class="card-value" id="available">)" << available << R"(</div>
+</div>
+<div class="card">
+<div class="card-label">Cars</div>
+<div class="card-value" id="cars">)" << numCars << R"(</div>
+</div>
+<div class="card">
+<div class="card-label">Bikes</div>
+<div class="card-value" id="bikes">)" << numBikes << R"(</div>
+</div>
+<div class="card">
+<div class="card-label">Trucks</div>
+<div class="card-value" id="trucks">)" << numTrucks << R"(</div>
+</div>
+<div class="card">
+<div class="card-label">Active</div>
+<div class="card-value" id="active">)" << numActive << R"(</div>
+</div>
+</div>
+
+<div class="usage-card">
+<div style="display:flex;justify-content:space-between;align-items:center;margin-bottom:8px">
+<span class="card-label">Parking Usage</span>
+<span style="font-weight:600;color:#333" id="usage-percent">)" << fixed << setprecision(0) << usage << R"(%</span>
+</div>
+<div class="bar"><div class="fill" id="usage-bar" style="width:)" << usage << R"(%"></div></div>
+</div>
+
+<div class="actions">
+<div class="action-panel">
+<h2>🚙 Park Vehicle</h2>
+<form id="parkForm" onsubmit="parkVehicle(event)">
+<div class="form-group">
+<label>Vehicle Type</label>
+<select name="type" required>
+<option value="">Select Type</option>
+<option value="Car">Car (Rs 20/hr)</option>
+<option value="Bike">Bike (Rs 10/hr)</option>
+<option value="Truck">Truck (Rs 30/hr)</option>
+</select>
+</div>
+<div class="form-group">
+<label>Plate Number</label>
+<input type="text" name="plate" placeholder="e.g., MH12AB1234" required>
+</div>
+<div class="form-group">
+<label>Owner Name</label>
+<input type="text" name="owner" placeholder="Enter owner name" required>
+</div>
+<button type="submit">Park Vehicle</button>
+</form>
+</div>
+
+<div class="action-panel">
+<h2>🚪 Exit Vehicle</h2>
+<form id="exitForm" onsubmit="exitVehicle(event)">
+<div class="form-group">
+<label>Plate Number</label>
+<input type="text" name="plate" placeholder="Enter plate number" required>
+</div>
+<button type="submit">Exit Vehicle</button>
+</form>
+</div>
+</div>
+
+<div class="vehicles-table">
+<h2 style="padding:20px 20px 0;font-size:20px;color:#333">📋 Vehicle List</h2>
+<table>
+<thead>
+<tr>
+<th>#</th>
+<th>Type</th>
+<th>Plate Number</th>
+<th>Owner</th>
+<th>Entry Time</th>
+<th>Status</th>
+<th>Exit Time</th>
+</tr>
+</thead>
+<tbody id="vehicles-table-body">
+)HTML";
+
+        for (const Vehicle* p : list) {
+            const auto &v = *p;
+            char entryBuf[32];
+            strftime(entryBuf, sizeof(entryBuf), "%Y-%m-%d %H:%M:%S", localtime(&v.entryTime));
+            std::string exitStr = "-";
+            if (v.exitTime != 0) {
+                char exitBuf[32];
+                strftime(exitBuf, sizeof(exitBuf), "%Y-%m-%d %H:%M:%S", localtime(&v.exitTime));
+                exitStr = exitBuf;
+            }
+            html << "<tr><td>" << v.slot << "</td><td>" << v.type << "</td><td>" << v.plateNumber 
+                 << "</td><td>" << v.ownerName << "</td><td>" << entryBuf << "</td><td>"
+                 << (v.isParked ? "<span class=\"status status-parked\">Parked</span>" 
+                     : "<span class=\"status status-exited\">Exited</span>")
+                 << "</td><td>" << exitStr << "</td></tr>\n";
+        }
+
+        html << R"HTML(
+</tbody>
+</table>
+</div>
+</div>
+
+<button class="refresh-btn" onclick="refreshData()" title="Refresh">🔄</button>
+
+<script>
+function showMessage(text, isError) {
+    const msg = document.getElementById('message');
+    msg.textContent = text;
+    msg.className = 'message ' + (isError ? 'message-error' : 'message-success');
+    msg.style.display = 'block';
+    setTimeout(() => msg.style.display = 'none', 3000);
+}
+
+function parkVehicle(e) {
+    e.preventDefault();
+    const form = e.target;
+    const formData = new FormData(form);
+    const data = Object.fromEntries(formData);
+    
+    fetch('/park', {
+        method: 'POST',
+        headers: {'Content-Type': 'application/x-www-form-urlencoded'},
+        body: new URLSearchParams(data)
+    })
+    .then(r => r.json())
+    .then(result => {
+        if (result.success) {
+            showMessage('Vehicle parked successfully!', false);
+            form.reset();
+            refreshData();
+        } else {
+            showMessage(result.message || 'Failed to park vehicle', true);
+        }
+    })
+    .catch(err => showMessage('Error: ' + err, true));
+}
+
+function exitVehicle(e) {
+    e.preventDefault();
+    const form = e.target;
+    const formData = new FormData(form);
+    const plate = formData.get('plate');
+    
+    fetch('/exit', {
+        method: 'POST',
+        headers: {'Content-Type': 'application/x-www-form-urlencoded'},
+        body: 'plate=' + encodeURIComponent(plate)
+    })
+    .then(r => r.json())
+    .then(result => {
+        if (result.success) {
+            showMessage('Vehicle exited successfully! Fee: Rs ' + result.fee, false);
+            form.reset();
+            refreshData();
+            } else {
+            showMessage(result.message || 'Vehicle not found', true);
+        }
+    })
+    .catch(err => showMessage('Error: ' + err, true));
+}
+
+function refreshData() {
+    fetch('/data')
+    .then(r => r.json())
+    .then(data => {
+        document.getElementById('capacity').textContent = data.capacity;
+        document.getElementById('occupied').textContent = data.occupied;
+        document.getElementById('available').textContent = data.available;
+        document.getElementById('cars').textContent = data.stats.cars;
+        document.getElementById('bikes').textContent = data.stats.bikes;
+        document.getElementById('trucks').textContent = data.stats.trucks;
+        document.getElementById('active').textContent = data.stats.active;
+        
+        const usage = data.capacity > 0 ? (100 * data.occupied / data.capacity) : 0;
+        document.getElementById('usage-percent').textContent = usage.toFixed(0) + '%';
+        document.getElementById('usage-bar').style.width = usage + '%';
+        
+        const tbody = document.getElementById('vehicles-table-body');
+        tbody.innerHTML = data.vehicles.map(v => {
+            const status = v.parked ? 
+                '<span class=\"status status-parked\">Parked</span>' : 
+                '<span class=\"status status-exited\">Exited</span>';
+            return '<tr>' +
+                '<td>' + v.slot + '</td>' +
+                '<td>' + v.type + '</td>' +
+                '<td>' + v.plate + '</td>' +
+                '<td>' + v.owner + '</td>' +
+                '<td>' + v.entry + '</td>' +
+                '<td>' + status + '</td>' +
+                '<td>' + v.exit + '</td>' +
+            '</tr>';
+        }).join('');
+    })
+    .catch(err => console.error('Refresh error:', err));
+}
+
+setInterval(refreshData, 2000);
+</script>
+</body>
+</html>)HTML";
+        return html.str();
+    }
+};
+
+#endif
@@ -0,0 +1,440 @@
+// Offline discrete-event simulator for ParkingLot.
+//
+// Drives a lot with a VirtualClock, so a day of traffic runs in milliseconds.
+// Arrivals and departures come either from configurable distributions or
+// from replaying an existing parking_log.txt. Reports occupancy, rejected
+// arrivals, revenue and the cost of each ParkingLot operation. In a replay
+// every logged park was accepted when it was written, so refusals are listed
+// as inconsistencies between the log and the simulated lot.
+//
+// Usage: parking_sim [options]
+//   --capacity N        lot size (default 10)
+//   --hours H           simulated duration for generated traffic (default 24)
+//   --arrivals R        mean arrivals per hour (default 12)
+//   --arrival-dist D    poisson | fixed (default poisson)
+//   --dwell M           mean stay in minutes (default 90)
+//   --dwell-dist D      exp | lognormal | fixed (default exp)
+//   --mix C,B,T         car/bike/truck weights (default 6,3,1)
+//   --seed S            random seed (default 1)
+//   --replay FILE       replay [PARK]/[EXIT] lines from a log instead
+//   --speed N           pace replay at N x real time (default 0 = unpaced);
+//                       idle gaps longer than an hour of log time are paced
+//                       as one hour, so gaps between sessions don't stall it
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <queue>
+#include <random>
+#include <chrono>
+#include <thread>
+#include <cstdlib>
+#include <cmath>
+#include "parking_lot.h"
+using namespace std;
+
+struct SimVehicle {
+    string plate;
+    string owner;
+    string type;
+};
+
+struct Event {
+    double at;          // seconds since the epoch; the lot's clock sees it rounded
+    uint64_t seq;       // keeps events at the same time in schedule order
+    bool arrival;
+    uint32_t vehicle;   // index into Simulator::vehicles
+
+    bool operator>(const Event& other) const {
+        if (at != other.at) return at > other.at;
+        return seq > other.seq;
+    }
+};
+
+struct SimConfig {
+    int capacity = 10;
+    double hours = 24;
+    double arrivalsPerHour = 12;
+    string arrivalDist = "poisson";
+    double dwellMinutes = 90;
+    string dwellDist = "exp";
+    double mix[3] = {6, 3, 1};
+    unsigned seed = 1;
+    string replayPath;
+    double speed = 0;
+};
+
+struct SimStats {
+    uint64_t arrivals = 0;
+    uint64_t rejectedFull = 0;
+    uint64_t rejectedDuplicate = 0; // plate already parked
+    uint64_t departures = 0;
+    uint64_t unmatchedExits = 0;
+    uint64_t drainDepartures = 0;   // vehicles leaving after the --hours window
+    double drainRevenue = 0;
+    int peakOccupied = 0;
+    double occupiedSeconds = 0;
+    double revenue = 0;
+    uint64_t parkSamples = 0;
+    uint64_t exitSamples = 0;
+    double parkNanos = 0;
+    double exitNanos = 0;
+};
+
+// Only every SAMPLE_EVERY-th park/exit call is timed, so the clock reads
+// barely touch the loop; their own cost is measured once and subtracted.
+const uint64_t SAMPLE_EVERY = 16;
+
+// Longest stretch of log time a paced replay actually waits through.
+const double MAX_PACED_GAP = 3600;
+
+class Simulator {
+private:
+    SimConfig config;
+    VirtualClock clock;
+    ParkingLot lot;
+    priority_queue<Event, vector<Event>, greater<Event>> events;
+    vector<SimVehicle> vehicles;
+    vector<uint32_t> freeVehicles;  // generated vehicles that have left, reused for new arrivals
+    mt19937_64 rng;
+    discrete_distribution<int> typeDist;
+    uint64_t nextSeq;
+    double start;
+    double end;
+    double timerOverheadNanos;
+    SimStats stats;
+
+    static LotOptions quietOptions() {
+        LotOptions opts;
+        opts.logPath = "";
+        opts.echo = false;
+        opts.historyLimit = 0;
+        return opts;
+    }
+
+    void schedule(double at, bool arrival, uint32_t vehicle) {
+        events.push(Event{at, nextSeq++, arrival, vehicle});
+    }
+
+    uint32_t addVehicle(const string& plate, const string& owner, const string& type) {
+        vehicles.push_back(SimVehicle{plate, owner, type});
+        return (uint32_t)(vehicles.size() - 1);
+    }
+
+    void releaseVehicle(uint32_t id, bool replay) {
+        if (!replay) freeVehicles.push_back(id);
+    }
+
+    double nextArrivalGap() {
+        double meanSeconds = 3600.0 / config.arrivalsPerHour;
+        if (config.arrivalDist == "fixed") return meanSeconds;
+        exponential_distribution<double> gap(1.0 / meanSeconds);
+        return gap(rng);
+    }
+
+    double dwellTime() {
+        double meanSeconds = config.dwellMinutes * 60.0;
+        double d = meanSeconds;
+        if (config.dwellDist == "exp") {
+            exponential_distribution<double> dist(1.0 / meanSeconds);
+            d = dist(rng);
+        } else if (config.dwellDist == "lognormal") {
+            // sigma 0.75 gives the long tail of all-day parkers; mu keeps the mean.
+            const double sigma = 0.75;
+            lognormal_distribution<double> dist(log(meanSeconds) - sigma * sigma / 2, sigma);
+            d = dist(rng);
+        }
+        return d;
+    }
+
+    void scheduleGeneratedArrival(double at) {
+        if (at >= end) return;
+        static const char* names[] = {"Car", "Bike", "Truck"};
+
+        // Only vehicles currently in the lot hold a plate, so a departed
+        // vehicle's slot in the pool can carry the next arrival.
+        uint32_t id;
+        if (!freeVehicles.empty()) {
+            id = freeVehicles.back();
+            freeVehicles.pop_back();
+            vehicles[id].type = names[typeDist(rng)];
+        } else {
+            id = addVehicle("SIM" + to_string(vehicles.size()), "sim", names[typeDist(rng)]);
+        }
+        schedule(at, true, id);
+    }
+
+    bool loadReplay() {
+        ifstream in(config.replayPath);
+        if (!in) {
+            cout << "[ERROR] Unable to open " << config.replayPath << endl;
+            return false;
+        }
+
+        string line;
+        while (getline(in, line)) {
+            bool arrival = line.rfind("[PARK] ", 0) == 0;
+            bool departure = line.rfind("[EXIT] ", 0) == 0;
+            if (!arrival && !departure) continue;
+
+            // "[PARK] Car MH12 | Owner: x | Entry: <asctime>[ | Exit: <asctime> | Fee: ...]"
+            istringstream head(line.substr(7, line.find(" | ") - 7));
+            string type, plate;
+            head >> type >> plate;
+
+            string owner;
+            size_t ownerPos = line.find("Owner: ");
+            if (ownerPos != string::npos) {
+                owner = line.substr(ownerPos + 7, line.find(" | ", ownerPos) - ownerPos - 7);
+            }
+
+            const char* key = arrival ? "Entry: " : "Exit: ";
+            size_t timePos = line.find(key);
+            if (timePos == string::npos) continue;
+            tm when = {};
+            istringstream stamp(line.substr(timePos + strlen(key)));
+            stamp >> get_time(&when, "%a %b %d %H:%M:%S %Y");
+            if (stamp.fail()) continue;
+            when.tm_isdst = -1;
+
+            double at = (double)mktime(&when);
+            schedule(at, arrival, addVehicle(plate, owner, type));
+            end = max(end, at);
+        }
+
+        if (events.empty()) {
+            cout << "[ERROR] No [PARK]/[EXIT] records in " << config.replayPath << endl;
+            return false;
+        }
+        start = events.top().at;
+        return true;
+    }
+
+    static double measureTimerOverhead() {
+        const int rounds = 100000;
+        volatile double sink = 0;
+        auto t0 = chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            auto a = chrono::steady_clock::now();
+            sink = sink + chrono::duration<double, nano>(chrono::steady_clock::now() - a).count();
+        }
+        return chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count() / rounds;
+    }
+
+public:
+    Simulator(const SimConfig& cfg)
+        : config(cfg), clock(0), lot(cfg.capacity, &clock, quietOptions()),
+          rng(cfg.seed), typeDist({cfg.mix[0], cfg.mix[1], cfg.mix[2]}), nextSeq(0), start(0), end(0),
+          timerOverheadNanos(measureTimerOverhead()) {}
+
+    bool run() {
+        bool replay = !config.replayPath.empty();
+        if (replay) {
+            if (!loadReplay()) return false;
+        } else {
+            // Start at local midnight so reports read like a calendar day.
+            tm day = {};
+            day.tm_year = 125;
+            day.tm_mday = 1;
+            day.tm_isdst = -1;
+            start = (double)mktime(&day);
+            end = start + config.hours * 3600;
+            scheduleGeneratedArrival(start + nextArrivalGap());
+        }
+
+        clock.set((time_t)llround(start));
+        double last = start;
+        int occupied = 0;
+        uint64_t parkCalls = 0, exitCalls = 0;
+        double pausedSeconds = 0;
+        auto wallStart = chrono::steady_clock::now();
+
+        while (!events.empty()) {
+            Event ev = events.top();
+            events.pop();
+            const SimVehicle& v = vehicles[ev.vehicle];
+
+            if (replay && config.speed > 0 && ev.at > last) {
+                auto p0 = chrono::steady_clock::now();
+                double gap = min(ev.at - last, MAX_PACED_GAP);
+                this_thread::sleep_for(chrono::duration<double>(gap / config.speed));
+                pausedSeconds += chrono::duration<double>(chrono::steady_clock::now() - p0).count();
+            }
+
+            // Occupancy and revenue only count inside [start, end]; vehicles
+            // still parked at the end drain afterwards and are reported apart.
+            double windowAt = min(ev.at, end);
+            if (windowAt > last) {
+                stats.occupiedSeconds += (double)occupied * (windowAt - last);
+                last = windowAt;
+            }
+            clock.set((time_t)llround(ev.at));
+
+            if (ev.arrival) {
+                stats.arrivals++;
+                ParkResult result;
+                if (parkCalls++ % SAMPLE_EVERY == 0) {
+                    auto t0 = chrono::steady_clock::now();
+                    result = lot.parkVehicle(v.plate, v.owner, v.type);
+                    stats.parkNanos += chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+                    stats.parkSamples++;
+                } else {
+                    result = lot.parkVehicle(v.plate, v.owner, v.type);
+                }
+
+                if (result == PARK_OK) {
+                    occupied++;
+                    if (occupied > stats.peakOccupied) stats.peakOccupied = occupied;
+                    if (!replay) schedule(ev.at + dwellTime(), false, ev.vehicle);
+                } else {
+                    if (result == PARK_FULL) stats.rejectedFull++;
+                    else stats.rejectedDuplicate++;
+                    releaseVehicle(ev.vehicle, replay);
+                }
+                if (!replay) scheduleGeneratedArrival(ev.at + nextArrivalGap());
+            } else {
+                double fee = 0;
+                bool left;
+                if (exitCalls++ % SAMPLE_EVERY == 0) {
+                    auto t0 = chrono::steady_clock::now();
+                    left = lot.exitVehicle(v.plate, &fee);
+                    stats.exitNanos += chrono::duration<double, nano>(chrono::steady_clock::now() - t0).count();
+                    stats.exitSamples++;
+                } else {
+                    left = lot.exitVehicle(v.plate, &fee);
+                }
+
+                if (left) {
+                    occupied--;
+                    if (ev.at <= end) {
+                        stats.departures++;
+                        stats.revenue += fee;
+                    } else {
+                        stats.drainDepartures++;
+                        stats.drainRevenue += fee;
+                    }
+                    releaseVehicle(ev.vehicle, replay);
+                } else {
+                    stats.unmatchedExits++;
+                }
+            }
+        }
+
+        if (last < end) {
+            stats.occupiedSeconds += (double)occupied * (end - last);
+        }
+
+        double wallSeconds = chrono::duration<double>(chrono::steady_clock::now() - wallStart).count();
+        report(replay, end - start, wallSeconds - pausedSeconds);
+        return true;
+    }
+
+    double costPerOp(double nanos, uint64_t samples) {
+        if (samples == 0) return 0;
+        return max(0.0, nanos / samples - timerOverheadNanos);
+    }
+
+    void report(bool replay, double simulatedSeconds, double wallSeconds) {
+        uint64_t totalEvents = stats.arrivals + stats.departures + stats.drainDepartures + stats.unmatchedExits;
+        double avgOccupied = simulatedSeconds > 0 ? stats.occupiedSeconds / simulatedSeconds : 0;
+
+        cout << fixed << setprecision(2);
+        cout << "\n========================================" << endl;
+        cout << "   Smart Parking System - Simulation" << endl;
+        cout << "========================================" << endl;
+        cout << "Simulated time     : " << simulatedSeconds / 3600.0 << " h" << endl;
+        cout << "Capacity           : " << config.capacity << endl;
+        cout << "Arrivals           : " << stats.arrivals << endl;
+        if (!replay) {
+            cout << "Rejected arrivals  : " << stats.rejectedFull << " ("
+                 << (stats.arrivals ? 100.0 * stats.rejectedFull / stats.arrivals : 0.0) << "%)" << endl;
+            if (stats.rejectedDuplicate) {
+                cout << "Duplicate plates   : " << stats.rejectedDuplicate << endl;
+            }
+        }
+        cout << "Departures         : " << stats.departures << endl;
+        if (replay) {
+            uint64_t refused = stats.rejectedFull + stats.rejectedDuplicate;
+            cout << "Log inconsistencies: " << refused + stats.unmatchedExits
+                 << " (the logging server accepted every park)" << endl;
+            cout << "  parks refused, lot full       : " << stats.rejectedFull << endl;
+            cout << "  parks refused, already parked : " << stats.rejectedDuplicate << endl;
+            cout << "  exits of plates not parked    : " << stats.unmatchedExits << endl;
+        } else if (stats.unmatchedExits) {
+            cout << "Unmatched exits    : " << stats.unmatchedExits << endl;
+        }
+        cout << "Average occupancy  : " << avgOccupied << " ("
+             << (config.capacity ? 100.0 * avgOccupied / config.capacity : 0.0) << "%)" << endl;
+        cout << "Peak occupancy     : " << stats.peakOccupied << endl;
+        cout << "Revenue            : Rs " << stats.revenue << endl;
+        if (stats.drainDepartures) {
+            cout << "Drain after window : " << stats.drainDepartures << " departures, Rs "
+                 << stats.drainRevenue << endl;
+        }
+        cout << "Park cost          : " << costPerOp(stats.parkNanos, stats.parkSamples) << " ns/op" << endl;
+        cout << "Exit cost          : " << costPerOp(stats.exitNanos, stats.exitSamples) << " ns/op" << endl;
+        cout << "Events             : " << totalEvents << " in " << wallSeconds << " s ("
+             << setprecision(0) << (wallSeconds > 0 ? totalEvents / wallSeconds : 0.0) << " events/s)" << endl;
+    }
+};
+
+static bool parseArgs(int argc, char* argv[], SimConfig& cfg) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (i + 1 >= argc) {
+            cout << "[ERROR] Missing value for " << arg << endl;
+            return false;
+        }
+        string value = argv[++i];
+
+        if (arg == "--capacity") cfg.capacity = atoi(value.c_str());
+        else if (arg == "--hours") cfg.hours = atof(value.c_str());
+        else if (arg == "--arrivals") cfg.arrivalsPerHour = atof(value.c_str());
+        else if (arg == "--arrival-dist") cfg.arrivalDist = value;
+        else if (arg == "--dwell") cfg.dwellMinutes = atof(value.c_str());
+        else if (arg == "--dwell-dist") cfg.dwellDist = value;
+        else if (arg == "--seed") cfg.seed = (unsigned)strtoul(value.c_str(), nullptr, 10);
+        else if (arg == "--replay") cfg.replayPath = value;
+        else if (arg == "--speed") cfg.speed = atof(value.c_str());
+        else if (arg == "--mix") {
+            char sep;
+            istringstream mix(value);
+            if (!(mix >> cfg.mix[0] >> sep >> cfg.mix[1] >> sep >> cfg.mix[2])) {
+                cout << "[ERROR] --mix expects car,bike,truck weights" << endl;
+                return false;
+            }
+        }
+        else {
+            cout << "[ERROR] Unknown option " << arg << endl;
+            return false;
+        }
+    }
+
+    if (cfg.capacity <= 0 || cfg.hours <= 0 || cfg.arrivalsPerHour <= 0 || cfg.dwellMinutes <= 0) {
+        cout << "[ERROR] capacity, hours, arrivals and dwell must be positive" << endl;
+        return false;
+    }
+    if (cfg.arrivalDist != "poisson" && cfg.arrivalDist != "fixed") {
+        cout << "[ERROR] --arrival-dist must be poisson or fixed" << endl;
+        return false;
+    }
+    if (cfg.dwellDist != "exp" && cfg.dwellDist != "lognormal" && cfg.dwellDist != "fixed") {
+        cout << "[ERROR] --dwell-dist must be exp, lognormal or fixed" << endl;
+        return false;
+    }
+    if (cfg.mix[0] < 0 || cfg.mix[1] < 0 || cfg.mix[2] < 0 || cfg.mix[0] + cfg.mix[1] + cfg.mix[2] <= 0) {
+        cout << "[ERROR] --mix weights must be non-negative and not all zero" << endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    SimConfig cfg;
+    if (!parseArgs(argc, argv, cfg)) return 1;
+
+    Simulator sim(cfg);
+    return sim.run() ? 0 : 1;
+}